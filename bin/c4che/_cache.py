@@ -0,0 +1,3 @@
+BINDIR = '/usr/local/samba/bin'
+LIBDIR = '/usr/local/samba/lib64'
+PREFIX = '/usr/local/samba'
@@ -0,0 +1,4 @@
+#define LDB_VERSION "1.5.5"
+#define LDB_VERSION_MAJOR 1
+#define LDB_VERSION_MINOR 5
+#define LDB_VERSION_RELEASE 5
@@ -0,0 +1,6 @@
+#include "librpc/rpc/dcerpc.h"
+#include "bin/default/librpc/gen_ndr/auth.h"
+#ifndef _HEADER_RPC_auth
+#define _HEADER_RPC_auth
+
+#endif /* _HEADER_RPC_auth */
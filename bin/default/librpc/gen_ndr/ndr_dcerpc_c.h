@@ -0,0 +1,6 @@
+#include "librpc/rpc/dcerpc.h"
+#include "bin/default/librpc/gen_ndr/dcerpc.h"
+#ifndef _HEADER_RPC_dcerpc
+#define _HEADER_RPC_dcerpc
+
+#endif /* _HEADER_RPC_dcerpc */
@@ -0,0 +1,13 @@
+/* header auto-generated by pidl */
+
+#include "librpc/ndr/libndr.h"
+#include "bin/default/librpc/gen_ndr/file_id.h"
+
+#ifndef _HEADER_NDR_file_id
+#define _HEADER_NDR_file_id
+
+#define NDR_FILE_ID_CALL_COUNT (0)
+enum ndr_err_code ndr_push_file_id(struct ndr_push *ndr, int ndr_flags, const struct file_id *r);
+enum ndr_err_code ndr_pull_file_id(struct ndr_pull *ndr, int ndr_flags, struct file_id *r);
+void ndr_print_file_id(struct ndr_print *ndr, const char *name, const struct file_id *r);
+#endif /* _HEADER_NDR_file_id */
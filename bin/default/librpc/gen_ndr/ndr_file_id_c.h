@@ -0,0 +1,6 @@
+#include "librpc/rpc/dcerpc.h"
+#include "bin/default/librpc/gen_ndr/file_id.h"
+#ifndef _HEADER_RPC_file_id
+#define _HEADER_RPC_file_id
+
+#endif /* _HEADER_RPC_file_id */
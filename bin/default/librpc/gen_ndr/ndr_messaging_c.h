@@ -0,0 +1,6 @@
+#include "librpc/rpc/dcerpc.h"
+#include "bin/default/librpc/gen_ndr/messaging.h"
+#ifndef _HEADER_RPC_messaging
+#define _HEADER_RPC_messaging
+
+#endif /* _HEADER_RPC_messaging */
@@ -0,0 +1,14 @@
+#include "librpc/rpc/dcerpc.h"
+#include "bin/default/librpc/gen_ndr/msgsvc.h"
+#ifndef _HEADER_RPC_msgsvc
+#define _HEADER_RPC_msgsvc
+
+extern const struct ndr_interface_table ndr_table_msgsvc;
+
+#endif /* _HEADER_RPC_msgsvc */
+#ifndef _HEADER_RPC_msgsvcsend
+#define _HEADER_RPC_msgsvcsend
+
+extern const struct ndr_interface_table ndr_table_msgsvcsend;
+
+#endif /* _HEADER_RPC_msgsvcsend */
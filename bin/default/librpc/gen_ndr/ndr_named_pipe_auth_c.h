@@ -0,0 +1,6 @@
+#include "librpc/rpc/dcerpc.h"
+#include "bin/default/librpc/gen_ndr/named_pipe_auth.h"
+#ifndef _HEADER_RPC_named_pipe_auth
+#define _HEADER_RPC_named_pipe_auth
+
+#endif /* _HEADER_RPC_named_pipe_auth */
@@ -0,0 +1,6 @@
+#include "librpc/rpc/dcerpc.h"
+#include "bin/default/librpc/gen_ndr/schannel.h"
+#ifndef _HEADER_RPC_schannel
+#define _HEADER_RPC_schannel
+
+#endif /* _HEADER_RPC_schannel */
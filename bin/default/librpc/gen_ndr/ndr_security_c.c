@@ -0,0 +1,774 @@
+/* client functions auto-generated by pidl */
+
+#include "includes.h"
+#include <tevent.h>
+#include "lib/util/tevent_ntstatus.h"
+#include "bin/default/librpc/gen_ndr/ndr_security.h"
+#include "bin/default/librpc/gen_ndr/ndr_security_c.h"
+
+/* security - client functions generated by pidl */
+
+struct dcerpc_decode_security_descriptor_r_state {
+	TALLOC_CTX *out_mem_ctx;
+};
+
+static void dcerpc_decode_security_descriptor_r_done(struct tevent_req *subreq);
+
+struct tevent_req *dcerpc_decode_security_descriptor_r_send(TALLOC_CTX *mem_ctx,
+	struct tevent_context *ev,
+	struct dcerpc_binding_handle *h,
+	struct decode_security_descriptor *r)
+{
+	struct tevent_req *req;
+	struct dcerpc_decode_security_descriptor_r_state *state;
+	struct tevent_req *subreq;
+
+	req = tevent_req_create(mem_ctx, &state,
+				struct dcerpc_decode_security_descriptor_r_state);
+	if (req == NULL) {
+		return NULL;
+	}
+
+	state->out_mem_ctx = NULL;
+
+	subreq = dcerpc_binding_handle_call_send(state, ev, h,
+			NULL, &ndr_table_security,
+			NDR_DECODE_SECURITY_DESCRIPTOR, state, r);
+	if (tevent_req_nomem(subreq, req)) {
+		return tevent_req_post(req, ev);
+	}
+	tevent_req_set_callback(subreq, dcerpc_decode_security_descriptor_r_done, req);
+
+	return req;
+}
+
+static void dcerpc_decode_security_descriptor_r_done(struct tevent_req *subreq)
+{
+	struct tevent_req *req =
+		tevent_req_callback_data(subreq,
+		struct tevent_req);
+	NTSTATUS status;
+
+	status = dcerpc_binding_handle_call_recv(subreq);
+	TALLOC_FREE(subreq);
+	if (tevent_req_nterror(req, status)) {
+		return;
+	}
+
+	tevent_req_done(req);
+}
+
+NTSTATUS dcerpc_decode_security_descriptor_r_recv(struct tevent_req *req, TALLOC_CTX *mem_ctx)
+{
+	struct dcerpc_decode_security_descriptor_r_state *state =
+		tevent_req_data(req,
+		struct dcerpc_decode_security_descriptor_r_state);
+	NTSTATUS status;
+
+	if (tevent_req_is_nterror(req, &status)) {
+		tevent_req_received(req);
+		return status;
+	}
+
+	talloc_steal(mem_ctx, state->out_mem_ctx);
+
+	tevent_req_received(req);
+	return NT_STATUS_OK;
+}
+
+NTSTATUS dcerpc_decode_security_descriptor_r(struct dcerpc_binding_handle *h, TALLOC_CTX *mem_ctx, struct decode_security_descriptor *r)
+{
+	NTSTATUS status;
+
+	status = dcerpc_binding_handle_call(h,
+			NULL, &ndr_table_security,
+			NDR_DECODE_SECURITY_DESCRIPTOR, mem_ctx, r);
+
+	return status;
+}
+
+struct dcerpc_decode_security_descriptor_state {
+	struct decode_security_descriptor orig;
+	struct decode_security_descriptor tmp;
+	TALLOC_CTX *out_mem_ctx;
+};
+
+static void dcerpc_decode_security_descriptor_done(struct tevent_req *subreq);
+
+struct tevent_req *dcerpc_decode_security_descriptor_send(TALLOC_CTX *mem_ctx,
+							  struct tevent_context *ev,
+							  struct dcerpc_binding_handle *h,
+							  struct security_descriptor _sd /* [in]  */)
+{
+	struct tevent_req *req;
+	struct dcerpc_decode_security_descriptor_state *state;
+	struct tevent_req *subreq;
+
+	req = tevent_req_create(mem_ctx, &state,
+				struct dcerpc_decode_security_descriptor_state);
+	if (req == NULL) {
+		return NULL;
+	}
+	state->out_mem_ctx = NULL;
+
+	/* In parameters */
+	state->orig.in.sd = _sd;
+
+	/* Out parameters */
+
+	/* make a temporary copy, that we pass to the dispatch function */
+	state->tmp = state->orig;
+
+	subreq = dcerpc_decode_security_descriptor_r_send(state, ev, h, &state->tmp);
+	if (tevent_req_nomem(subreq, req)) {
+		return tevent_req_post(req, ev);
+	}
+	tevent_req_set_callback(subreq, dcerpc_decode_security_descriptor_done, req);
+	return req;
+}
+
+static void dcerpc_decode_security_descriptor_done(struct tevent_req *subreq)
+{
+	struct tevent_req *req = tevent_req_callback_data(
+		subreq, struct tevent_req);
+	struct dcerpc_decode_security_descriptor_state *state = tevent_req_data(
+		req, struct dcerpc_decode_security_descriptor_state);
+	NTSTATUS status;
+	TALLOC_CTX *mem_ctx;
+
+	if (state->out_mem_ctx) {
+		mem_ctx = state->out_mem_ctx;
+	} else {
+		mem_ctx = state;
+	}
+
+	status = dcerpc_decode_security_descriptor_r_recv(subreq, mem_ctx);
+	TALLOC_FREE(subreq);
+	if (tevent_req_nterror(req, status)) {
+		return;
+	}
+
+	/* Copy out parameters */
+
+	/* Reset temporary structure */
+	NDR_ZERO_STRUCT(state->tmp);
+
+	tevent_req_done(req);
+}
+
+NTSTATUS dcerpc_decode_security_descriptor_recv(struct tevent_req *req,
+						TALLOC_CTX *mem_ctx)
+{
+	struct dcerpc_decode_security_descriptor_state *state = tevent_req_data(
+		req, struct dcerpc_decode_security_descriptor_state);
+	NTSTATUS status;
+
+	if (tevent_req_is_nterror(req, &status)) {
+		tevent_req_received(req);
+		return status;
+	}
+
+	/* Steal possible out parameters to the callers context */
+	talloc_steal(mem_ctx, state->out_mem_ctx);
+
+	tevent_req_received(req);
+	return NT_STATUS_OK;
+}
+
+NTSTATUS dcerpc_decode_security_descriptor(struct dcerpc_binding_handle *h,
+					   TALLOC_CTX *mem_ctx,
+					   struct security_descriptor _sd /* [in]  */)
+{
+	struct decode_security_descriptor r;
+	NTSTATUS status;
+
+	/* In parameters */
+	r.in.sd = _sd;
+
+	/* Out parameters */
+
+	status = dcerpc_decode_security_descriptor_r(h, mem_ctx, &r);
+	if (!NT_STATUS_IS_OK(status)) {
+		return status;
+	}
+
+	/* Return variables */
+
+	/* Return result */
+
+	return NT_STATUS_OK;
+}
+
+struct dcerpc_decode_sec_desc_buf_r_state {
+	TALLOC_CTX *out_mem_ctx;
+};
+
+static void dcerpc_decode_sec_desc_buf_r_done(struct tevent_req *subreq);
+
+struct tevent_req *dcerpc_decode_sec_desc_buf_r_send(TALLOC_CTX *mem_ctx,
+	struct tevent_context *ev,
+	struct dcerpc_binding_handle *h,
+	struct decode_sec_desc_buf *r)
+{
+	struct tevent_req *req;
+	struct dcerpc_decode_sec_desc_buf_r_state *state;
+	struct tevent_req *subreq;
+
+	req = tevent_req_create(mem_ctx, &state,
+				struct dcerpc_decode_sec_desc_buf_r_state);
+	if (req == NULL) {
+		return NULL;
+	}
+
+	state->out_mem_ctx = NULL;
+
+	subreq = dcerpc_binding_handle_call_send(state, ev, h,
+			NULL, &ndr_table_security,
+			NDR_DECODE_SEC_DESC_BUF, state, r);
+	if (tevent_req_nomem(subreq, req)) {
+		return tevent_req_post(req, ev);
+	}
+	tevent_req_set_callback(subreq, dcerpc_decode_sec_desc_buf_r_done, req);
+
+	return req;
+}
+
+static void dcerpc_decode_sec_desc_buf_r_done(struct tevent_req *subreq)
+{
+	struct tevent_req *req =
+		tevent_req_callback_data(subreq,
+		struct tevent_req);
+	NTSTATUS status;
+
+	status = dcerpc_binding_handle_call_recv(subreq);
+	TALLOC_FREE(subreq);
+	if (tevent_req_nterror(req, status)) {
+		return;
+	}
+
+	tevent_req_done(req);
+}
+
+NTSTATUS dcerpc_decode_sec_desc_buf_r_recv(struct tevent_req *req, TALLOC_CTX *mem_ctx)
+{
+	struct dcerpc_decode_sec_desc_buf_r_state *state =
+		tevent_req_data(req,
+		struct dcerpc_decode_sec_desc_buf_r_state);
+	NTSTATUS status;
+
+	if (tevent_req_is_nterror(req, &status)) {
+		tevent_req_received(req);
+		return status;
+	}
+
+	talloc_steal(mem_ctx, state->out_mem_ctx);
+
+	tevent_req_received(req);
+	return NT_STATUS_OK;
+}
+
+NTSTATUS dcerpc_decode_sec_desc_buf_r(struct dcerpc_binding_handle *h, TALLOC_CTX *mem_ctx, struct decode_sec_desc_buf *r)
+{
+	NTSTATUS status;
+
+	status = dcerpc_binding_handle_call(h,
+			NULL, &ndr_table_security,
+			NDR_DECODE_SEC_DESC_BUF, mem_ctx, r);
+
+	return status;
+}
+
+struct dcerpc_decode_sec_desc_buf_state {
+	struct decode_sec_desc_buf orig;
+	struct decode_sec_desc_buf tmp;
+	TALLOC_CTX *out_mem_ctx;
+};
+
+static void dcerpc_decode_sec_desc_buf_done(struct tevent_req *subreq);
+
+struct tevent_req *dcerpc_decode_sec_desc_buf_send(TALLOC_CTX *mem_ctx,
+						   struct tevent_context *ev,
+						   struct dcerpc_binding_handle *h,
+						   struct sec_desc_buf _sd_buf /* [in]  */)
+{
+	struct tevent_req *req;
+	struct dcerpc_decode_sec_desc_buf_state *state;
+	struct tevent_req *subreq;
+
+	req = tevent_req_create(mem_ctx, &state,
+				struct dcerpc_decode_sec_desc_buf_state);
+	if (req == NULL) {
+		return NULL;
+	}
+	state->out_mem_ctx = NULL;
+
+	/* In parameters */
+	state->orig.in.sd_buf = _sd_buf;
+
+	/* Out parameters */
+
+	/* make a temporary copy, that we pass to the dispatch function */
+	state->tmp = state->orig;
+
+	subreq = dcerpc_decode_sec_desc_buf_r_send(state, ev, h, &state->tmp);
+	if (tevent_req_nomem(subreq, req)) {
+		return tevent_req_post(req, ev);
+	}
+	tevent_req_set_callback(subreq, dcerpc_decode_sec_desc_buf_done, req);
+	return req;
+}
+
+static void dcerpc_decode_sec_desc_buf_done(struct tevent_req *subreq)
+{
+	struct tevent_req *req = tevent_req_callback_data(
+		subreq, struct tevent_req);
+	struct dcerpc_decode_sec_desc_buf_state *state = tevent_req_data(
+		req, struct dcerpc_decode_sec_desc_buf_state);
+	NTSTATUS status;
+	TALLOC_CTX *mem_ctx;
+
+	if (state->out_mem_ctx) {
+		mem_ctx = state->out_mem_ctx;
+	} else {
+		mem_ctx = state;
+	}
+
+	status = dcerpc_decode_sec_desc_buf_r_recv(subreq, mem_ctx);
+	TALLOC_FREE(subreq);
+	if (tevent_req_nterror(req, status)) {
+		return;
+	}
+
+	/* Copy out parameters */
+
+	/* Reset temporary structure */
+	NDR_ZERO_STRUCT(state->tmp);
+
+	tevent_req_done(req);
+}
+
+NTSTATUS dcerpc_decode_sec_desc_buf_recv(struct tevent_req *req,
+					 TALLOC_CTX *mem_ctx)
+{
+	struct dcerpc_decode_sec_desc_buf_state *state = tevent_req_data(
+		req, struct dcerpc_decode_sec_desc_buf_state);
+	NTSTATUS status;
+
+	if (tevent_req_is_nterror(req, &status)) {
+		tevent_req_received(req);
+		return status;
+	}
+
+	/* Steal possible out parameters to the callers context */
+	talloc_steal(mem_ctx, state->out_mem_ctx);
+
+	tevent_req_received(req);
+	return NT_STATUS_OK;
+}
+
+NTSTATUS dcerpc_decode_sec_desc_buf(struct dcerpc_binding_handle *h,
+				    TALLOC_CTX *mem_ctx,
+				    struct sec_desc_buf _sd_buf /* [in]  */)
+{
+	struct decode_sec_desc_buf r;
+	NTSTATUS status;
+
+	/* In parameters */
+	r.in.sd_buf = _sd_buf;
+
+	/* Out parameters */
+
+	status = dcerpc_decode_sec_desc_buf_r(h, mem_ctx, &r);
+	if (!NT_STATUS_IS_OK(status)) {
+		return status;
+	}
+
+	/* Return variables */
+
+	/* Return result */
+
+	return NT_STATUS_OK;
+}
+
+struct dcerpc_decode_security_token_r_state {
+	TALLOC_CTX *out_mem_ctx;
+};
+
+static void dcerpc_decode_security_token_r_done(struct tevent_req *subreq);
+
+struct tevent_req *dcerpc_decode_security_token_r_send(TALLOC_CTX *mem_ctx,
+	struct tevent_context *ev,
+	struct dcerpc_binding_handle *h,
+	struct decode_security_token *r)
+{
+	struct tevent_req *req;
+	struct dcerpc_decode_security_token_r_state *state;
+	struct tevent_req *subreq;
+
+	req = tevent_req_create(mem_ctx, &state,
+				struct dcerpc_decode_security_token_r_state);
+	if (req == NULL) {
+		return NULL;
+	}
+
+	state->out_mem_ctx = NULL;
+
+	subreq = dcerpc_binding_handle_call_send(state, ev, h,
+			NULL, &ndr_table_security,
+			NDR_DECODE_SECURITY_TOKEN, state, r);
+	if (tevent_req_nomem(subreq, req)) {
+		return tevent_req_post(req, ev);
+	}
+	tevent_req_set_callback(subreq, dcerpc_decode_security_token_r_done, req);
+
+	return req;
+}
+
+static void dcerpc_decode_security_token_r_done(struct tevent_req *subreq)
+{
+	struct tevent_req *req =
+		tevent_req_callback_data(subreq,
+		struct tevent_req);
+	NTSTATUS status;
+
+	status = dcerpc_binding_handle_call_recv(subreq);
+	TALLOC_FREE(subreq);
+	if (tevent_req_nterror(req, status)) {
+		return;
+	}
+
+	tevent_req_done(req);
+}
+
+NTSTATUS dcerpc_decode_security_token_r_recv(struct tevent_req *req, TALLOC_CTX *mem_ctx)
+{
+	struct dcerpc_decode_security_token_r_state *state =
+		tevent_req_data(req,
+		struct dcerpc_decode_security_token_r_state);
+	NTSTATUS status;
+
+	if (tevent_req_is_nterror(req, &status)) {
+		tevent_req_received(req);
+		return status;
+	}
+
+	talloc_steal(mem_ctx, state->out_mem_ctx);
+
+	tevent_req_received(req);
+	return NT_STATUS_OK;
+}
+
+NTSTATUS dcerpc_decode_security_token_r(struct dcerpc_binding_handle *h, TALLOC_CTX *mem_ctx, struct decode_security_token *r)
+{
+	NTSTATUS status;
+
+	status = dcerpc_binding_handle_call(h,
+			NULL, &ndr_table_security,
+			NDR_DECODE_SECURITY_TOKEN, mem_ctx, r);
+
+	return status;
+}
+
+struct dcerpc_decode_security_token_state {
+	struct decode_security_token orig;
+	struct decode_security_token tmp;
+	TALLOC_CTX *out_mem_ctx;
+};
+
+static void dcerpc_decode_security_token_done(struct tevent_req *subreq);
+
+struct tevent_req *dcerpc_decode_security_token_send(TALLOC_CTX *mem_ctx,
+						     struct tevent_context *ev,
+						     struct dcerpc_binding_handle *h,
+						     struct security_token _token /* [in]  */)
+{
+	struct tevent_req *req;
+	struct dcerpc_decode_security_token_state *state;
+	struct tevent_req *subreq;
+
+	req = tevent_req_create(mem_ctx, &state,
+				struct dcerpc_decode_security_token_state);
+	if (req == NULL) {
+		return NULL;
+	}
+	state->out_mem_ctx = NULL;
+
+	/* In parameters */
+	state->orig.in.token = _token;
+
+	/* Out parameters */
+
+	/* make a temporary copy, that we pass to the dispatch function */
+	state->tmp = state->orig;
+
+	subreq = dcerpc_decode_security_token_r_send(state, ev, h, &state->tmp);
+	if (tevent_req_nomem(subreq, req)) {
+		return tevent_req_post(req, ev);
+	}
+	tevent_req_set_callback(subreq, dcerpc_decode_security_token_done, req);
+	return req;
+}
+
+static void dcerpc_decode_security_token_done(struct tevent_req *subreq)
+{
+	struct tevent_req *req = tevent_req_callback_data(
+		subreq, struct tevent_req);
+	struct dcerpc_decode_security_token_state *state = tevent_req_data(
+		req, struct dcerpc_decode_security_token_state);
+	NTSTATUS status;
+	TALLOC_CTX *mem_ctx;
+
+	if (state->out_mem_ctx) {
+		mem_ctx = state->out_mem_ctx;
+	} else {
+		mem_ctx = state;
+	}
+
+	status = dcerpc_decode_security_token_r_recv(subreq, mem_ctx);
+	TALLOC_FREE(subreq);
+	if (tevent_req_nterror(req, status)) {
+		return;
+	}
+
+	/* Copy out parameters */
+
+	/* Reset temporary structure */
+	NDR_ZERO_STRUCT(state->tmp);
+
+	tevent_req_done(req);
+}
+
+NTSTATUS dcerpc_decode_security_token_recv(struct tevent_req *req,
+					   TALLOC_CTX *mem_ctx)
+{
+	struct dcerpc_decode_security_token_state *state = tevent_req_data(
+		req, struct dcerpc_decode_security_token_state);
+	NTSTATUS status;
+
+	if (tevent_req_is_nterror(req, &status)) {
+		tevent_req_received(req);
+		return status;
+	}
+
+	/* Steal possible out parameters to the callers context */
+	talloc_steal(mem_ctx, state->out_mem_ctx);
+
+	tevent_req_received(req);
+	return NT_STATUS_OK;
+}
+
+NTSTATUS dcerpc_decode_security_token(struct dcerpc_binding_handle *h,
+				      TALLOC_CTX *mem_ctx,
+				      struct security_token _token /* [in]  */)
+{
+	struct decode_security_token r;
+	NTSTATUS status;
+
+	/* In parameters */
+	r.in.token = _token;
+
+	/* Out parameters */
+
+	status = dcerpc_decode_security_token_r(h, mem_ctx, &r);
+	if (!NT_STATUS_IS_OK(status)) {
+		return status;
+	}
+
+	/* Return variables */
+
+	/* Return result */
+
+	return NT_STATUS_OK;
+}
+
+struct dcerpc_decode_security_unix_token_r_state {
+	TALLOC_CTX *out_mem_ctx;
+};
+
+static void dcerpc_decode_security_unix_token_r_done(struct tevent_req *subreq);
+
+struct tevent_req *dcerpc_decode_security_unix_token_r_send(TALLOC_CTX *mem_ctx,
+	struct tevent_context *ev,
+	struct dcerpc_binding_handle *h,
+	struct decode_security_unix_token *r)
+{
+	struct tevent_req *req;
+	struct dcerpc_decode_security_unix_token_r_state *state;
+	struct tevent_req *subreq;
+
+	req = tevent_req_create(mem_ctx, &state,
+				struct dcerpc_decode_security_unix_token_r_state);
+	if (req == NULL) {
+		return NULL;
+	}
+
+	state->out_mem_ctx = NULL;
+
+	subreq = dcerpc_binding_handle_call_send(state, ev, h,
+			NULL, &ndr_table_security,
+			NDR_DECODE_SECURITY_UNIX_TOKEN, state, r);
+	if (tevent_req_nomem(subreq, req)) {
+		return tevent_req_post(req, ev);
+	}
+	tevent_req_set_callback(subreq, dcerpc_decode_security_unix_token_r_done, req);
+
+	return req;
+}
+
+static void dcerpc_decode_security_unix_token_r_done(struct tevent_req *subreq)
+{
+	struct tevent_req *req =
+		tevent_req_callback_data(subreq,
+		struct tevent_req);
+	NTSTATUS status;
+
+	status = dcerpc_binding_handle_call_recv(subreq);
+	TALLOC_FREE(subreq);
+	if (tevent_req_nterror(req, status)) {
+		return;
+	}
+
+	tevent_req_done(req);
+}
+
+NTSTATUS dcerpc_decode_security_unix_token_r_recv(struct tevent_req *req, TALLOC_CTX *mem_ctx)
+{
+	struct dcerpc_decode_security_unix_token_r_state *state =
+		tevent_req_data(req,
+		struct dcerpc_decode_security_unix_token_r_state);
+	NTSTATUS status;
+
+	if (tevent_req_is_nterror(req, &status)) {
+		tevent_req_received(req);
+		return status;
+	}
+
+	talloc_steal(mem_ctx, state->out_mem_ctx);
+
+	tevent_req_received(req);
+	return NT_STATUS_OK;
+}
+
+NTSTATUS dcerpc_decode_security_unix_token_r(struct dcerpc_binding_handle *h, TALLOC_CTX *mem_ctx, struct decode_security_unix_token *r)
+{
+	NTSTATUS status;
+
+	status = dcerpc_binding_handle_call(h,
+			NULL, &ndr_table_security,
+			NDR_DECODE_SECURITY_UNIX_TOKEN, mem_ctx, r);
+
+	return status;
+}
+
+struct dcerpc_decode_security_unix_token_state {
+	struct decode_security_unix_token orig;
+	struct decode_security_unix_token tmp;
+	TALLOC_CTX *out_mem_ctx;
+};
+
+static void dcerpc_decode_security_unix_token_done(struct tevent_req *subreq);
+
+struct tevent_req *dcerpc_decode_security_unix_token_send(TALLOC_CTX *mem_ctx,
+							  struct tevent_context *ev,
+							  struct dcerpc_binding_handle *h,
+							  struct security_unix_token _unix_token /* [in]  */)
+{
+	struct tevent_req *req;
+	struct dcerpc_decode_security_unix_token_state *state;
+	struct tevent_req *subreq;
+
+	req = tevent_req_create(mem_ctx, &state,
+				struct dcerpc_decode_security_unix_token_state);
+	if (req == NULL) {
+		return NULL;
+	}
+	state->out_mem_ctx = NULL;
+
+	/* In parameters */
+	state->orig.in.unix_token = _unix_token;
+
+	/* Out parameters */
+
+	/* make a temporary copy, that we pass to the dispatch function */
+	state->tmp = state->orig;
+
+	subreq = dcerpc_decode_security_unix_token_r_send(state, ev, h, &state->tmp);
+	if (tevent_req_nomem(subreq, req)) {
+		return tevent_req_post(req, ev);
+	}
+	tevent_req_set_callback(subreq, dcerpc_decode_security_unix_token_done, req);
+	return req;
+}
+
+static void dcerpc_decode_security_unix_token_done(struct tevent_req *subreq)
+{
+	struct tevent_req *req = tevent_req_callback_data(
+		subreq, struct tevent_req);
+	struct dcerpc_decode_security_unix_token_state *state = tevent_req_data(
+		req, struct dcerpc_decode_security_unix_token_state);
+	NTSTATUS status;
+	TALLOC_CTX *mem_ctx;
+
+	if (state->out_mem_ctx) {
+		mem_ctx = state->out_mem_ctx;
+	} else {
+		mem_ctx = state;
+	}
+
+	status = dcerpc_decode_security_unix_token_r_recv(subreq, mem_ctx);
+	TALLOC_FREE(subreq);
+	if (tevent_req_nterror(req, status)) {
+		return;
+	}
+
+	/* Copy out parameters */
+
+	/* Reset temporary structure */
+	NDR_ZERO_STRUCT(state->tmp);
+
+	tevent_req_done(req);
+}
+
+NTSTATUS dcerpc_decode_security_unix_token_recv(struct tevent_req *req,
+						TALLOC_CTX *mem_ctx)
+{
+	struct dcerpc_decode_security_unix_token_state *state = tevent_req_data(
+		req, struct dcerpc_decode_security_unix_token_state);
+	NTSTATUS status;
+
+	if (tevent_req_is_nterror(req, &status)) {
+		tevent_req_received(req);
+		return status;
+	}
+
+	/* Steal possible out parameters to the callers context */
+	talloc_steal(mem_ctx, state->out_mem_ctx);
+
+	tevent_req_received(req);
+	return NT_STATUS_OK;
+}
+
+NTSTATUS dcerpc_decode_security_unix_token(struct dcerpc_binding_handle *h,
+					   TALLOC_CTX *mem_ctx,
+					   struct security_unix_token _unix_token /* [in]  */)
+{
+	struct decode_security_unix_token r;
+	NTSTATUS status;
+
+	/* In parameters */
+	r.in.unix_token = _unix_token;
+
+	/* Out parameters */
+
+	status = dcerpc_decode_security_unix_token_r(h, mem_ctx, &r);
+	if (!NT_STATUS_IS_OK(status)) {
+		return status;
+	}
+
+	/* Return variables */
+
+	/* Return result */
+
+	return NT_STATUS_OK;
+}
+
@@ -0,0 +1,10 @@
+/* client functions auto-generated by pidl */
+
+#include "includes.h"
+#include <tevent.h>
+#include "lib/util/tevent_ntstatus.h"
+#include "bin/default/librpc/gen_ndr/ndr_smb2_lease_struct.h"
+#include "bin/default/librpc/gen_ndr/ndr_smb2_lease_struct_c.h"
+
+/* smb2_lease_struct - client functions generated by pidl */
+
@@ -0,0 +1,6 @@
+#include "librpc/rpc/dcerpc.h"
+#include "bin/default/librpc/gen_ndr/smb2_lease_struct.h"
+#ifndef _HEADER_RPC_smb2_lease_struct
+#define _HEADER_RPC_smb2_lease_struct
+
+#endif /* _HEADER_RPC_smb2_lease_struct */
@@ -0,0 +1,8 @@
+#include "librpc/rpc/dcerpc.h"
+#include "bin/default/librpc/gen_ndr/w32time.h"
+#ifndef _HEADER_RPC_w32time
+#define _HEADER_RPC_w32time
+
+extern const struct ndr_interface_table ndr_table_w32time;
+
+#endif /* _HEADER_RPC_w32time */
@@ -0,0 +1,6 @@
+#include "librpc/rpc/dcerpc.h"
+#include "bin/default/librpc/gen_ndr/windows_event_ids.h"
+#ifndef _HEADER_RPC_windows_events
+#define _HEADER_RPC_windows_events
+
+#endif /* _HEADER_RPC_windows_events */
@@ -0,0 +1,4 @@
+/* server functions auto-generated by pidl */
+#include "bin/default/librpc/gen_ndr/ndr_wmi.h"
+#include <util/debug.h>
+
@@ -0,0 +1,6 @@
+#include "librpc/rpc/dcerpc.h"
+#include "bin/default/librpc/gen_ndr/xattr.h"
+#ifndef _HEADER_RPC_xattr
+#define _HEADER_RPC_xattr
+
+#endif /* _HEADER_RPC_xattr */